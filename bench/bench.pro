@@ -0,0 +1,18 @@
+QT -= gui
+
+TEMPLATE = app
+TARGET   = fsmBench
+
+CONFIG += c++2a console link_pkgconfig release
+
+PKGCONFIG *= fmt
+
+INCLUDEPATH += ../src
+
+SOURCES += \
+        fsmBench.C \
+        sm.C
+
+HEADERS += \
+    ../src/fsm.H \
+    sm.H
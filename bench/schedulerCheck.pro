@@ -0,0 +1,17 @@
+QT -= core gui
+
+TEMPLATE = app
+TARGET   = schedulerCheck
+
+CONFIG += c++2a console link_pkgconfig
+
+PKGCONFIG *= fmt
+
+INCLUDEPATH += ../src
+
+SOURCES += \
+        schedulerCheck.C \
+        ../src/scheduler.C
+
+HEADERS += \
+    ../src/scheduler.H
@@ -0,0 +1,24 @@
+QT -= gui
+QT *= dbus network
+
+TEMPLATE = app
+TARGET   = sleepwalkHarness
+
+CONFIG += c++2a console link_pkgconfig
+
+PKGCONFIG *= fmt
+
+isEmpty(LOG_LEVEL): LOG_LEVEL = 2
+DEFINES *= SLEEPWALK_LOG_LEVEL=$$LOG_LEVEL
+
+INCLUDEPATH += ../src
+
+# the daemon without its main, application_t and inhibit_t run in the harness process
+SOURCES += \
+        $$files(*.C) \
+        $$files(../src/*.C)
+SOURCES -= ../src/main.C
+
+HEADERS += \
+    $$files(*.H) \
+    $$files(../src/*.H)
@@ -8,6 +8,13 @@ CONFIG += c++2a console link_pkgconfig
 
 PKGCONFIG *= fmt
 
+# 0 errors, 1 info, 2 debug; release builds compile out the per-transition and per-frame logging
+isEmpty(LOG_LEVEL) {
+    CONFIG(debug, debug|release): LOG_LEVEL = 2
+    else: LOG_LEVEL = 1
+}
+DEFINES *= SLEEPWALK_LOG_LEVEL=$$LOG_LEVEL
+
 SOURCES += \
         $$files(src/*.C)
 